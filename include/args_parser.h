@@ -4,14 +4,25 @@
 #include <string_view>
 #include <optional>
 #include <map>
+#include <set>
 #include <array>
 #include <vector>
-#include <iostream>
-#include <fstream>
+#include <cstdio>
 #include <charconv>
 #include <exception>
 #include <type_traits>
 #include <algorithm>
+#include <memory>
+#include <cctype>
+#include <coroutine>
+#include <iterator>
+#include <utility>
+
+#if defined(_WIN32)
+#include <stdlib.h>
+#elif defined(__APPLE__)
+#include <crt_externs.h>
+#endif
 
 
 namespace util {
@@ -47,9 +58,9 @@ namespace util {
 
     // if input is not valid, it throws
     template<typename T>
-    T from_string(const std::string &src) {
+    T from_string(std::string_view src) {
         if constexpr (std::is_same_v<std::string, std::decay_t<T>>) {
-            return src;
+            return std::string{src};
         } else if constexpr (std::is_same_v<char, std::decay_t<T>>) {
             assert_statement(src.size() == 1,
                              "Can't convert [", src, "], size: [", src.size(), "] to char");
@@ -71,22 +82,35 @@ namespace util {
 
     /* To strip the string (only from beginning and end) off any characters in @chars
      * - with default of being space chars
-     * e.g. strip("   Hello World! ") -> "Hello World!"
+     * - the result is a view into @source, so @source must outlive it
+     * e.g. strip_view("   Hello World! ") -> "Hello World!"
      * */
     inline
-    std::string strip(std::string_view source, std::string_view chars = " ") {
+    std::string_view strip_view(std::string_view source, std::string_view chars = " ") {
         auto first = source.find_first_not_of(chars);
+        if (first == std::string_view::npos) { // @source is either empty or made of @chars only
+            return source.substr(0, 0);
+        }
         auto last = source.find_last_not_of(chars);
-        return std::string{source.substr(first, last - first + 1)};
+        return source.substr(first, last - first + 1);
+    }
+
+    // same as @strip_view, but returns an owning copy
+    inline
+    std::string strip(std::string_view source, std::string_view chars = " ") {
+        return std::string{strip_view(source, chars)};
     }
 
     /*
      * To split a function based on a separator string
      * - if there are repeated occurrences of the separator, all are ignored
+     * - throws @std::invalid_argument if @sep is empty
      * e.g. split("Hello123World", "123") -> ["Hello", "World"]
      * */
     inline
     std::vector<std::string> split(std::string_view source, const std::string_view sep) {
+        assert_statement(!sep.empty(), "Separator can't be empty");
+
         // some quick sanity checks
         while (source.starts_with(sep)) { // as source might have multiple occurrences of sep at the beginning
             source = source.substr(sep.size());
@@ -123,6 +147,194 @@ namespace util {
         return split(source, to_string(sep));
     }
 
+    /*
+     * A lazy sequence of values of type @T, produced by a coroutine which uses co_yield (like C++23's std::generator)
+     * - the coroutine runs only as far as needed to produce the next value, so values can be consumed one at a time
+     * - an exception thrown by the coroutine is rethrown to the consumer, when the iterator is advanced to that point
+     * - it is a single pass range, i.e. @begin must be called only once
+     * */
+    template<typename T>
+    class Generator {
+    public:
+        struct promise_type {
+            // points to the last yielded value, which lives in the coroutine until it is resumed again
+            const T *value{nullptr};
+            std::exception_ptr exception{};
+
+            Generator get_return_object() noexcept { return Generator{handle_type::from_promise(*this)}; }
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            std::suspend_always final_suspend() const noexcept { return {}; }
+
+            std::suspend_always yield_value(const T &yielded) noexcept {
+                value = std::addressof(yielded);
+                return {};
+            }
+
+            void return_void() const noexcept {}
+
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+        };
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        class Iterator {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() = default;
+
+            explicit Iterator(handle_type handle) : _handle(handle) {}
+
+            const T &operator*() const { return *_handle.promise().value; }
+
+            Iterator &operator++() {
+                resume(_handle);
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(const Iterator &itr, std::default_sentinel_t) noexcept {
+                return !itr._handle || itr._handle.done();
+            }
+
+        private:
+            handle_type _handle{};
+        };
+
+        Generator(Generator &&other) noexcept: _handle(std::exchange(other._handle, {})) {}
+
+        Generator &operator=(Generator &&other) noexcept {
+            std::swap(_handle, other._handle);
+            return *this;
+        }
+
+        ~Generator() {
+            if (_handle) _handle.destroy();
+        }
+
+        Iterator begin() {
+            resume(_handle);
+            return Iterator{_handle};
+        }
+
+        std::default_sentinel_t end() const noexcept { return {}; }
+
+    private:
+        explicit Generator(handle_type handle) noexcept: _handle(handle) {}
+
+        static void resume(handle_type handle) {
+            handle.resume();
+            if (auto exception = std::exchange(handle.promise().exception, {})) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        handle_type _handle;
+    };
+
+    /*
+     * Lazy version of @split, yields views into @source one at a time instead of collecting copies of them
+     * - so @source must outlive the generator, @sep is taken by value as the generator might outlive the caller's copy
+     * - throws @std::invalid_argument (when iterated) if @sep is empty
+     * e.g. lazy_split("Hello123World", "123") -> "Hello", "World"
+     * */
+    inline
+    Generator<std::string_view> lazy_split(std::string_view source, std::string sep) {
+        assert_statement(!sep.empty(), "Separator can't be empty");
+
+        for (auto pos = source.find(sep); !source.empty(); pos = source.find(sep)) {
+            if (pos != 0) co_yield source.substr(0, pos); // pos is 0 for repeated occurrences of @sep, which are ignored
+            if (pos == std::string_view::npos) break;
+            source.remove_prefix(pos + sep.size());
+        }
+    }
+
+    using FilePtr = std::unique_ptr<std::FILE, int (*)(std::FILE *)>;
+
+    // opens the file for binary read, throws if the file can't be opened
+    inline
+    FilePtr open_file(const std::string &path) {
+        FilePtr file{std::fopen(path.c_str(), "rb"), &std::fclose};
+        assert_statement(file != nullptr, "Couldn't open file [", path, "]");
+        return file;
+    }
+
+    // reads the whole file in one go, throws if the file can't be opened or read (e.g. it is a directory)
+    inline
+    std::string read_file(const std::string &path) {
+        const auto file = open_file(path);
+
+        std::string content{};
+        std::array<char, 4096> chunk{};
+        while (const auto size = std::fread(chunk.data(), sizeof(char), chunk.size(), file.get())) {
+            content.append(chunk.data(), size);
+        }
+        assert_statement(!std::ferror(file.get()), "Couldn't read file [", path, "]");
+        return content;
+    }
+
+    /*
+     * To append @words to @text, where the current line of @text is already filled up to @column
+     * - words are separated by (any number of) spaces, tabs or newlines and lines are wrapped to not exceed @width, unless a single
+     *   word doesn't fit. Wrapped lines are indented up to @column and the last line is terminated with '\n'
+     * e.g. append_wrapped(text = "--ids ", "Allowed ids for app", 6, 16) -> "--ids Allowed ids\n      for app\n"
+     * */
+    inline
+    void append_wrapped(std::string &text, std::string_view words, std::size_t column, std::size_t width) {
+        static constexpr std::string_view separators{" \t\n"};
+        std::size_t line_length{column};
+        bool is_line_start{true};
+
+        for (words = strip_view(words, separators); !words.empty(); words = strip_view(words, separators)) {
+            const auto word = words.substr(0, words.find_first_of(separators));
+            words.remove_prefix(word.size());
+
+            if (!is_line_start && line_length + 1 + word.size() > width) {
+                text.append(1, '\n').append(column, ' ');
+                line_length = column;
+            } else if (!is_line_start) {
+                text.append(1, ' ');
+                ++line_length;
+            }
+
+            text.append(word);
+            line_length += word.size();
+            is_line_start = false;
+        }
+        text.append(1, '\n');
+    }
+
+    // case insensitive comparison (for ASCII letters only)
+    inline
+    bool iequals(std::string_view lhs, std::string_view rhs) noexcept {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), [](unsigned char l, unsigned char r) {
+            return std::tolower(l) == std::tolower(r);
+        });
+    }
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+    namespace detail {
+        // POSIX doesn't require any header to declare it, declared here to not leak it out of this header
+        extern "C" char **environ;
+    }
+#endif
+
+    // the process environment, as a null terminated array of "name=value" strings
+    inline
+    char **environment() noexcept {
+#if defined(_WIN32)
+        return _environ;
+#elif defined(__APPLE__)
+        return *_NSGetEnviron(); // environ isn't available to shared libraries on macOS
+#else
+        return detail::environ;
+#endif
+    }
+
     template<typename ContainerT, typename ValueT>
     bool contains(const ContainerT &container, const ValueT &value) {
         return std::find(std::cbegin(container), std::cend(container), value) != std::cend(container);
@@ -177,8 +389,75 @@ public:
         template<typename T>
         std::vector<T> get_list(const std::string &arg, const std::string &sep = ",") const;
 
+        /**
+         * Same as @get_list, but values are converted lazily, one at a time, as the returned generator is iterated.
+         * So memory use doesn't grow with the length of the list, e.g.
+         * for (auto id: parsed_args.get_stream<int>("ids")) {...}
+         * @tparam T: type of value, same as for @get_list
+         * @param arg: the argument whose value to be extracted
+         * @param sep: separator for passed values
+         * @return: a @util::Generator of values converted to type @T. It shares the buffers of this instance, so it
+         *          can outlive it (e.g. when iterating over a temporary), but @argv passed to @parse must outlive it
+         *
+         * Throws @std::invalid_argument if @arg is unknown or @sep is empty, and while iterating if a value
+         * can't be converted to type @T
+         */
+        template<typename T>
+        util::Generator<T> get_stream(const std::string &arg, const std::string &sep = ",") const;
+
+        /**
+         * Same as @get_stream, but the value of @arg is the path of a file (e.g. a response file) which contains
+         * the values. File is read in fixed size chunks, so memory use doesn't depend on the size of the file
+         * (only on the size of the largest value)
+         * @tparam T: type of value, same as for @get_list
+         * @param arg: the argument whose value is the path of the file
+         * @param sep: separator for values in the file, e.g. "\n" for a value per line (CRLF line endings are fine too)
+         * @return: a @util::Generator of values converted to type @T
+         *
+         * Throws @std::invalid_argument if @arg is unknown, @sep is empty or the file can't be opened, and while
+         * iterating if the file can't be read (e.g. it is a directory) or a value can't be converted to type @T
+         */
+        template<typename T>
+        util::Generator<T> get_file_stream(const std::string &arg, const std::string &sep = "\n") const;
+
     private:
-        std::map<std::string, std::string> _arg_value_map;
+        friend class ArgsParser;
+        using ArgValueMap = std::map<std::string, std::string_view>;
+        using Buffers = std::vector<std::shared_ptr<const std::string>>;
+
+        ParsedArgs(ArgValueMap arg_value_map, Buffers buffers);
+
+        // these are the actual coroutines behind @get_stream and @get_file_stream, which take everything by value,
+        // so that nothing refers to the caller's (possibly temporary) arguments once they have returned
+        // - @buffers keeps @value alive, in case it refers to one of them
+        template<typename T>
+        static util::Generator<T> stream_values(std::string_view value, std::string sep, Buffers buffers);
+
+        template<typename T>
+        static util::Generator<T> stream_file(std::string path, util::FilePtr file, std::string sep);
+
+        // throws @std::invalid_argument if @arg is unknown
+        [[nodiscard]] std::string_view value_of(const std::string &arg) const noexcept(false);
+
+        // values are views into either the caller's argv or @_buffers,
+        // which are shared so that a copy of this instance still points to valid values
+        ArgValueMap _arg_value_map;
+        Buffers _buffers;
+    };
+
+    /**
+     * Additional sources of argument values, consulted by @parse after the command line arguments.
+     * Precedence (highest first): command line, environment, config files (the last one first), default values
+     */
+    struct Sources {
+        // only environment variables starting with this prefix are considered, the rest of the name is matched with
+        // args ignoring case, e.g. with "APP_", APP_LOG_PATH=/tmp provides value for "log_path" (or "Log_Path").
+        // If args differ only in case, the lower-cased one is preferred. Environment is not consulted if empty
+        std::string env_prefix;
+
+        // files with one "arg=value" per line, blank lines and lines starting with '#' are ignored.
+        // An arg can appear only once in a file, a later file is the way to override it
+        std::vector<std::string> config_files;
     };
 
     /**
@@ -216,14 +495,50 @@ public:
     /**
      * To parse the command line arguments. The expected arguments is exactly what is passed to @main function
      * @param argc: count of arguments
-     * @param argv: array of arguments
+     * @param argv: array of arguments, values are not copied so it must outlive the returned @ParsedArgs
      * @return: an instance of @ParsedArgs which contains parsed argument value pairs
      */
     [[nodiscard]] ParsedArgs parse(int argc, char *argv[]);
 
+    /**
+     * To parse the command line arguments along with environment variables and config files, in a single pass
+     * over each of them. Check @Sources for precedence of these
+     * @param argc: count of arguments
+     * @param argv: array of arguments, values are not copied so it must outlive the returned @ParsedArgs
+     * @param sources: environment prefix and config files to consult for args not passed in @argv
+     * @return: an instance of @ParsedArgs which contains parsed argument value pairs
+     *
+     * Throws @std::invalid_argument if a config file can't be read, or contains an unknown arg, an unexpected format
+     * or the same arg more than once.
+     * Unknown environment variables (even with @Sources::env_prefix) and ones with blank values are ignored, but
+     * known ones with an unexpected format (e.g. APP_IDS=1=2) throw too
+     */
+    [[nodiscard]] ParsedArgs parse(int argc, char *argv[], const Sources &sources);
+
+    /**
+     * To get the description of added arguments, as printed for --help. Mandatory and optional arguments are
+     * grouped separately, with aligned and wrapped descriptions
+     * @return: the help text, rendered once and then cached until another argument is added
+     *          (or @parse is called with a different app path)
+     */
+    [[nodiscard]] std::string_view help() const;
+
 private:
+    using ArgValueMap = ParsedArgs::ArgValueMap;
+
+    static std::pair<std::string_view, std::string_view> validate_and_parse(std::string_view passed_arg) noexcept(false);
+
+    // splits "arg=value" into stripped arg and value, returns @std::nullopt if either is empty or '=' is not unique
+    static std::optional<std::pair<std::string_view, std::string_view>> split_arg_value(std::string_view arg_value);
 
-    static std::pair<std::string, std::string> validate_and_parse(std::string_view passed_arg) noexcept(false);
+    // adds values of known args from environment variables starting with @prefix, unless already in @arg_value_map
+    // - values are copied into a single buffer, added to @buffers, as environment might change after parsing
+    void read_environment(std::string_view prefix, ArgValueMap &arg_value_map, ParsedArgs::Buffers &buffers) const;
+
+    // adds values from @content (of config file @path), unless already in @arg_value_map, throws for duplicate args
+    void read_config(const std::string &path, std::string_view content, ArgValueMap &arg_value_map) const;
+
+    [[nodiscard]] std::string render_help() const;
 
     void print_help() const;
 
@@ -233,15 +548,13 @@ private:
         std::string help;
     };
     std::string _app_path{};
-    std::map<std::string, ArgsAttributes> _args;
+    std::map<std::string, ArgsAttributes, std::less<>> _args;
+    mutable std::string _help_text{}; // empty until @help is called, cleared whenever it gets stale
 };
 
 template<class T>
 [[nodiscard]] T ArgsParser::ParsedArgs::get(const std::string &arg) const noexcept(false) {
-    auto itr = _arg_value_map.find(arg);
-    util::assert_statement(itr != _arg_value_map.end(),
-                           "Couldn't find [", arg, "] in arguments");
-    return util::from_string<T>(itr->second);
+    return util::from_string<T>(value_of(arg));
 }
 
 template<class T>
@@ -257,38 +570,69 @@ template<class T>
 bool ArgsParser::add_arg(std::string arg, T default_value, std::string description) {
     auto default_value_str = util::to_string(default_value);
     util::assert_statement(!default_value_str.empty(), "Default value is empty for [", arg, "]");
+    _help_text.clear();
     return _args.emplace(std::move(arg),
                          ArgsAttributes{true, std::move(default_value_str), std::move(description)}).second;
 }
 
 inline
 bool ArgsParser::add_arg(std::string arg, std::string description, bool is_optional) {
+    _help_text.clear();
     return _args.emplace(std::move(arg), ArgsAttributes{is_optional, std::string{}, std::move(description)}).second;
 }
 
 inline
 ArgsParser::ParsedArgs ArgsParser::parse(int argc, char *argv[]) {
+    return parse(argc, argv, Sources{});
+}
+
+inline
+ArgsParser::ParsedArgs ArgsParser::parse(int argc, char *argv[], const Sources &sources) {
     static constexpr std::array<const char *const, 3> help_args = {"help", "--help", "-h"};
 
-    _app_path = argv[0];
+    if (_app_path != argv[0]) {
+        _app_path = argv[0];
+        _help_text.clear();
+    }
     if (argc == 2 && util::contains(help_args, std::string{argv[1]})) {
         print_help();
         exit(0); // a rare case to call exit explicitly but seems like the right thing to do
     }
 
-    std::map<std::string, std::string> arg_value_map{};
+    // each source only adds args which are not there yet, so sources are visited in order of precedence
+    ArgValueMap arg_value_map{};
+    ParsedArgs::Buffers buffers{};
 
     for (int i = 1; i < argc; ++i) {
-        auto arg_value_str = std::string(argv[i]);
-        auto [arg, value] = validate_and_parse(arg_value_str);
-        util::assert_statement(_args.contains(arg), "Unknown arg: [", arg, "]. Try --help");
-        arg_value_map.emplace(std::move(arg), std::move(value));
+        const auto [arg, value] = validate_and_parse(argv[i]);
+        const auto itr = _args.find(arg);
+        util::assert_statement(itr != _args.end(), "Unknown arg: [", arg, "]. Try --help");
+        arg_value_map.try_emplace(itr->first, value);
+    }
+
+    if (!sources.env_prefix.empty()) {
+        read_environment(sources.env_prefix, arg_value_map, buffers);
+    }
+
+    for (auto itr = sources.config_files.crbegin(); itr != sources.config_files.crend(); ++itr) {
+        const auto &buffer = buffers.emplace_back(std::make_shared<const std::string>(util::read_file(*itr)));
+        read_config(*itr, *buffer, arg_value_map);
     }
 
     // Now, taking care of args with default values which were not explicitly passed
+    // - these are copied into a single buffer as @ParsedArgs might outlive this instance
+    std::string defaults{};
     for (const auto &[arg, attributes]: _args) {
         if (attributes.is_optional && !arg_value_map.contains(arg)) {
-            arg_value_map.emplace(arg, attributes.default_value);
+            defaults += attributes.default_value;
+        }
+    }
+    std::string_view remaining_defaults = *buffers.emplace_back(std::make_shared<const std::string>(std::move(defaults)));
+
+    for (const auto &[arg, attributes]: _args) {
+        if (attributes.is_optional && !arg_value_map.contains(arg)) {
+            arg_value_map.emplace(arg, remaining_defaults.substr(0, attributes.default_value.size()));
+            remaining_defaults.remove_prefix(attributes.default_value.size());
         }
 
         // and ensuring that the mandatory arguments were indeed passed
@@ -296,32 +640,168 @@ ArgsParser::ParsedArgs ArgsParser::parse(int argc, char *argv[]) {
                                "Mandatory argument [", arg, "] not passed in arguments. Try --help");
     }
 
-    return ParsedArgs(std::move(arg_value_map));
+    return ParsedArgs(std::move(arg_value_map), std::move(buffers));
 }
 
 inline
-void ArgsParser::print_help() const {
+void ArgsParser::read_environment(std::string_view prefix, ArgValueMap &arg_value_map,
+                                  ParsedArgs::Buffers &buffers) const {
+    std::string lower_case_arg{}; // reused for every variable, to lower-case the names without allocating each time
+    std::vector<ArgValueMap::iterator> added{};
+
+    for (char **env = util::environment(); env != nullptr && *env != nullptr; ++env) {
+        std::string_view variable{*env};
+        if (!variable.starts_with(prefix)) continue;
+        variable.remove_prefix(prefix.size());
+
+        const auto pos = variable.find('=');
+        if (pos == std::string_view::npos) continue;
+
+        const auto arg = variable.substr(0, pos);
+        lower_case_arg.assign(arg);
+        std::transform(lower_case_arg.cbegin(), lower_case_arg.cend(), lower_case_arg.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        // most args are lower-case, so looking that up first, before checking all args ignoring case
+        auto itr = _args.find(lower_case_arg);
+        if (itr == _args.end()) {
+            itr = std::find_if(_args.cbegin(), _args.cend(),
+                               [arg](const auto &arg_attributes) { return util::iequals(arg_attributes.first, arg); });
+        }
+
+        // environment is shared with everything else, so unknown variables are not an error
+        const auto value = util::strip_view(variable.substr(pos + 1));
+        if (itr == _args.end() || value.empty()) continue;
+
+        util::assert_statement(split_arg_value(variable).has_value(), "Unexpected format: [", *env,
+                               "], expected format is: [", prefix, "ARG=value]");
+        const auto [added_itr, is_added] = arg_value_map.try_emplace(itr->first, value);
+        if (is_added) added.push_back(added_itr);
+    }
 
-    std::cout << "Following is the list of configured arguments for " << _app_path << ":\n";
+    // now, pointing the added values to a copy instead, as environment is not guaranteed to stay the same
+    // - e.g. setenv/unsetenv might free these strings, or the caller of putenv might modify them
+    std::string values{};
+    for (const auto &itr: added) {
+        values += itr->second;
+    }
+    std::string_view remaining_values = *buffers.emplace_back(std::make_shared<const std::string>(std::move(values)));
 
+    for (const auto &itr: added) {
+        const auto size = itr->second.size();
+        itr->second = remaining_values.substr(0, size);
+        remaining_values.remove_prefix(size);
+    }
+}
+
+inline
+void ArgsParser::read_config(const std::string &path, std::string_view content, ArgValueMap &arg_value_map) const {
+    std::size_t line_number{0};
+    std::set<std::string_view> file_args{}; // only the ones in this file, as @arg_value_map has other sources too
+
+    while (!content.empty()) {
+        const auto pos = content.find('\n');
+        const auto line = util::strip_view(content.substr(0, pos), " \t\r");
+        content = (pos == std::string_view::npos) ? std::string_view{} : content.substr(pos + 1);
+        ++line_number;
+
+        if (line.empty() || line.starts_with('#')) continue;
+
+        const auto arg_value = split_arg_value(line);
+        util::assert_statement(arg_value.has_value(), "Unexpected format: [", line, "] at line [", line_number,
+                               "] of [", path, "], expected format is: [arg=value]");
+
+        const auto [arg, value] = *arg_value;
+        const auto itr = _args.find(arg);
+        util::assert_statement(itr != _args.end(), "Unknown arg: [", arg, "] in [", path, "]. Try --help");
+        util::assert_statement(file_args.insert(itr->first).second, "Duplicate arg: [", arg, "] at line [",
+                               line_number, "] of [", path, "]");
+        arg_value_map.try_emplace(itr->first, value);
+    }
+}
+
+inline
+std::string_view ArgsParser::help() const {
+    if (_help_text.empty()) {
+        _help_text = render_help();
+    }
+    return _help_text;
+}
+
+inline
+std::string ArgsParser::render_help() const {
+    static constexpr std::string_view help_arg{"help"};
+    static constexpr std::string_view help_description{"To print this message"};
+    static constexpr std::size_t indent{2};
+    static constexpr std::size_t gap{2};
+    static constexpr std::size_t width{80};
+    static constexpr std::size_t max_description_column{30};
+
+    // descriptions are aligned to the longest arg, so that has to be known beforehand
+    // - but only up to @max_description_column, longer args have their description on the next line
+    std::size_t name_width{help_arg.size()};
+    std::size_t estimated_size{_app_path.size() + 128};
+    bool has_mandatory{false};
     for (const auto &[arg, attributes]: _args) {
-        std::cout << "--" << arg << "\n\t";
-        std::cout << "Description: " << attributes.help << ", Optional: ["
-                  << (attributes.is_optional ? util::TRUE : util::FALSE) << "]";
+        name_width = std::max(name_width, arg.size());
+        has_mandatory = has_mandatory || !attributes.is_optional;
+        estimated_size += arg.size() + attributes.help.size() + attributes.default_value.size() + 32;
+    }
+    name_width = std::min(name_width, max_description_column - indent - 2 - gap);
+    const auto description_column = indent + 2 + name_width + gap;
 
-        if (attributes.is_optional && !attributes.default_value.empty()) {
-            std::cout << ", Default value: [" << attributes.default_value << "]";
+    std::string text{};
+    text.reserve(estimated_size + _args.size() * description_column);
+
+    std::string description{}; // reused for every arg
+    const auto append_arg = [&](std::string_view arg, std::string_view help, std::string_view default_value) {
+        description.assign(help);
+        if (!default_value.empty()) {
+            description.append(", Default value: [").append(default_value).append("]");
+        }
+        text.append(indent, ' ').append("--").append(arg);
+        if (util::strip_view(description, " \t\n").empty()) {
+            text.append(1, '\n'); // nothing to align, so no padding either
+            return;
         }
-        std::cout << "\n";
+        if (arg.size() > name_width) {
+            text.append(1, '\n').append(description_column, ' ');
+        } else {
+            text.append(name_width - arg.size() + gap, ' ');
+        }
+        util::append_wrapped(text, description, description_column, width);
+    };
+
+    text.append("Following is the list of configured arguments");
+    if (!_app_path.empty()) {
+        text.append(" for ").append(_app_path);
     }
+    text.append(":\n");
+
+    for (const auto is_optional: {false, true}) {
+        if (!is_optional && !has_mandatory) continue;
+        text.append(is_optional ? "Optional arguments:\n" : "Mandatory arguments:\n");
+        for (const auto &[arg, attributes]: _args) {
+            if (attributes.is_optional == is_optional) {
+                append_arg(arg, attributes.help, attributes.default_value);
+            }
+        }
+    }
+
+    // and finally, the help message itself
+    append_arg(help_arg, help_description, {});
+    return text;
+}
 
-    // now printing the help message
-    std::cout << "--help\n\tDescription: To print this message\n";
-    std::cout << std::endl;
+inline
+void ArgsParser::print_help() const {
+    const auto text = help();
+    std::fwrite(text.data(), sizeof(char), text.size(), stdout);
+    std::fflush(stdout);
 }
 
 inline
-std::pair<std::string, std::string> ArgsParser::validate_and_parse(std::string_view passed_arg) noexcept(false) {
+std::pair<std::string_view, std::string_view> ArgsParser::validate_and_parse(std::string_view passed_arg) noexcept(false) {
     // a handy lambda to be used for validating format
     const auto validate_format = [passed_arg](bool status) {
         util::assert_statement(status, "Unexpected format: [", passed_arg,
@@ -329,29 +809,112 @@ std::pair<std::string, std::string> ArgsParser::validate_and_parse(std::string_v
     };
 
     validate_format(passed_arg.starts_with("--"));
-    passed_arg = passed_arg.substr(2);
+    const auto arg_value = split_arg_value(passed_arg.substr(2));
+    validate_format(arg_value.has_value());
 
-    validate_format(std::count(passed_arg.cbegin(), passed_arg.cend(), '=') == 1);
-    const auto arg_value_pair = util::split(passed_arg, '=');
-    validate_format(arg_value_pair.size() == 2);
+    return *arg_value;
+}
 
-    auto arg = util::strip(arg_value_pair.at(0));
-    auto value = util::strip(arg_value_pair.at(1));
-    validate_format(!arg.empty() && !value.empty());
+inline
+std::optional<std::pair<std::string_view, std::string_view>> ArgsParser::split_arg_value(std::string_view arg_value) {
+    const auto pos = arg_value.find('=');
+    if (pos == std::string_view::npos || arg_value.find('=', pos + 1) != std::string_view::npos) {
+        return std::nullopt;
+    }
+
+    const auto arg = util::strip_view(arg_value.substr(0, pos));
+    const auto value = util::strip_view(arg_value.substr(pos + 1));
+    if (arg.empty() || value.empty()) {
+        return std::nullopt;
+    }
+    return std::make_pair(arg, value);
+}
 
-    return std::make_pair(std::move(arg), std::move(value));
+inline
+ArgsParser::ParsedArgs::ParsedArgs(std::map<std::string, std::string> arg_value_map) {
+    for (auto &[arg, value]: arg_value_map) {
+        const auto &buffer = _buffers.emplace_back(std::make_shared<const std::string>(std::move(value)));
+        _arg_value_map.emplace(arg, *buffer);
+    }
 }
 
 inline
-ArgsParser::ParsedArgs::ParsedArgs(std::map<std::string, std::string> arg_value_map) : _arg_value_map(
-        std::move(arg_value_map)) {}
+ArgsParser::ParsedArgs::ParsedArgs(ArgValueMap arg_value_map, Buffers buffers) :
+        _arg_value_map(std::move(arg_value_map)), _buffers(std::move(buffers)) {}
+
+inline
+std::string_view ArgsParser::ParsedArgs::value_of(const std::string &arg) const noexcept(false) {
+    auto itr = _arg_value_map.find(arg);
+    util::assert_statement(itr != _arg_value_map.end(),
+                           "Couldn't find [", arg, "] in arguments");
+    return itr->second;
+}
 
 template<typename T>
 std::vector<T> ArgsParser::ParsedArgs::get_list(const std::string &arg, const std::string& sep) const {
-    const auto strings = util::split(get(arg), sep);
+    const auto strings = util::split(value_of(arg), sep);
 
     std::vector<T> parsed_values{};
     std::transform(strings.cbegin(), strings.cend(), std::back_inserter(parsed_values),
                    [](const std::string &v) { return util::from_string<T>(v); });
     return parsed_values;
 }
+
+template<typename T>
+util::Generator<T> ArgsParser::ParsedArgs::get_stream(const std::string &arg, const std::string &sep) const {
+    // checked here, rather than in the coroutine, to throw right away instead of when it is iterated
+    util::assert_statement(!sep.empty(), "Separator can't be empty");
+    return stream_values<T>(value_of(arg), sep, _buffers);
+}
+
+template<typename T>
+util::Generator<T> ArgsParser::ParsedArgs::get_file_stream(const std::string &arg, const std::string &sep) const {
+    util::assert_statement(!sep.empty(), "Separator can't be empty");
+    std::string path{value_of(arg)};
+    auto file = util::open_file(path);
+    return stream_file<T>(std::move(path), std::move(file), sep);
+}
+
+template<typename T>
+util::Generator<T> ArgsParser::ParsedArgs::stream_values(std::string_view value, std::string sep,
+                                                         [[maybe_unused]] Buffers buffers) {
+    for (const auto sub_string: util::lazy_split(value, std::move(sep))) {
+        co_yield util::from_string<T>(sub_string);
+    }
+}
+
+template<typename T>
+util::Generator<T> ArgsParser::ParsedArgs::stream_file(std::string path, util::FilePtr file, std::string sep) {
+    static constexpr std::size_t chunk_size{64 * 1024};
+
+    // a value per line might come with CRLF line endings, e.g. from a file written on Windows
+    const bool is_line_separated = (sep == "\n");
+    const auto without_cr = [is_line_separated](std::string_view value) {
+        return (is_line_separated && value.ends_with('\r')) ? value.substr(0, value.size() - 1) : value;
+    };
+
+    // holds the current chunk, along with whatever was left incomplete at the end of the previous chunk
+    std::string pending{};
+    for (bool is_last_chunk = false; !is_last_chunk;) {
+        const auto pending_size = pending.size();
+        pending.resize(pending_size + chunk_size);
+        const auto read_size = std::fread(pending.data() + pending_size, sizeof(char), chunk_size, file.get());
+        pending.resize(pending_size + read_size);
+        is_last_chunk = read_size < chunk_size; // fread only returns less at the end of file, or on error
+        util::assert_statement(!is_last_chunk || !std::ferror(file.get()), "Couldn't read file [", path, "]");
+
+        // same as @util::split, except that the last value is incomplete (unless it is the last chunk)
+        std::string_view remaining{pending};
+        for (auto pos = remaining.find(sep); pos != std::string_view::npos; pos = remaining.find(sep)) {
+            if (const auto value = without_cr(remaining.substr(0, pos)); !value.empty()) {
+                co_yield util::from_string<T>(value);
+            }
+            remaining.remove_prefix(pos + sep.size());
+        }
+        if (const auto value = without_cr(remaining); is_last_chunk && !value.empty()) {
+            co_yield util::from_string<T>(value);
+        }
+
+        pending.erase(0, pending.size() - remaining.size());
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Checks util functions against their reference versions (reference.h) over a generated corpus, and files passed
+ * as arguments, if any. Reports mismatches and throughput of both, exits with non-zero status on any mismatch
+ * e.g. ./differential [rounds] [corpus files...]
+ * */
+#include <args_parser.h>
+#include "differential.h"
+#include "reference.h"
+#include <cstdlib>
+#include <random>
+
+namespace {
+    // lists of numbers, with some noise in between, to resemble values passed to get_list
+    std::vector<std::string> generate_corpus(std::size_t count) {
+        static constexpr std::string_view noise{" ,,|-+.e0x"};
+        std::mt19937 engine{42}; // fixed seed, so that runs are comparable
+        std::uniform_int_distribution<int> numbers{-1'000'000, 1'000'000};
+        std::uniform_int_distribution<std::size_t> lengths{0, 64};
+        std::uniform_int_distribution<std::size_t> noise_index{0, noise.size() - 1};
+        std::bernoulli_distribution is_noise{0.02};
+
+        std::vector<std::string> corpus{};
+        for (std::size_t i = 0; i < count; ++i) {
+            std::string input{};
+            for (auto length = lengths(engine); length > 0; --length) {
+                input.append(std::to_string(numbers(engine)));
+                input.append(1, is_noise(engine) ? noise[noise_index(engine)] : ',');
+            }
+            corpus.push_back(std::move(input));
+        }
+        return corpus;
+    }
+
+    // an input for ParsedArgs functions, parsed up front so that only extracting the values is measured
+    struct ParsedInput {
+        std::string value;
+        ArgsParser::ParsedArgs parsed_args;
+
+        [[nodiscard]] const char *data() const { return value.data(); }
+
+        [[nodiscard]] std::size_t size() const { return value.size(); }
+    };
+
+    std::vector<ParsedInput> parse_corpus(const std::vector<std::string> &corpus) {
+        std::vector<ParsedInput> parsed_corpus{};
+        for (const auto &input: corpus) {
+            parsed_corpus.push_back({input, ArgsParser::ParsedArgs{std::map<std::string, std::string>{{"ids", input}}}});
+        }
+        return parsed_corpus;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t rounds = argc > 1 ? util::from_string<std::size_t>(argv[1]) : 20;
+
+    auto corpus = generate_corpus(10'000);
+    for (int i = 2; i < argc; ++i) {
+        corpus.push_back(util::read_file(argv[i]));
+    }
+
+    const auto parsed_corpus = parse_corpus(corpus);
+
+    std::vector<std::string> numbers{};
+    for (const auto &input: corpus) {
+        for (auto &number: reference::split(input, ",")) numbers.push_back(std::move(number));
+    }
+
+    const std::vector<differential::Report> reports{
+            differential::compare("strip", corpus, [](std::string_view s) { return reference::strip(s, " ,"); },
+                                  [](std::string_view s) { return util::strip(s, " ,"); }, rounds),
+            differential::compare("split", corpus, [](std::string_view s) { return reference::split(s, ","); },
+                                  [](std::string_view s) { return util::split(s, ","); }, rounds),
+            differential::compare("lazy_split", corpus, [](std::string_view s) { return reference::split(s, ","); },
+                                  [](std::string_view s) {
+                                      std::vector<std::string> sub_strings{};
+                                      for (const auto sub_string: util::lazy_split(s, ",")) {
+                                          sub_strings.emplace_back(sub_string);
+                                      }
+                                      return sub_strings;
+                                  }, rounds),
+            differential::compare("from_string<int>", numbers,
+                                  [](std::string_view s) { return reference::from_string<int>(s); },
+                                  [](std::string_view s) { return util::from_string<int>(s); }, rounds),
+            differential::compare("from_string<double>", numbers,
+                                  [](std::string_view s) { return reference::from_string<double>(s); },
+                                  [](std::string_view s) { return util::from_string<double>(s); }, rounds),
+            differential::compare("get_list<int>", parsed_corpus,
+                                  [](const ParsedInput &input) { return reference::get_list<int>(input.value, ","); },
+                                  [](const ParsedInput &input) { return input.parsed_args.get_list<int>("ids"); },
+                                  rounds),
+            differential::compare("get_stream<int>", parsed_corpus,
+                                  [](const ParsedInput &input) { return reference::get_list<int>(input.value, ","); },
+                                  [](const ParsedInput &input) {
+                                      std::vector<int> values{};
+                                      for (auto value: input.parsed_args.get_stream<int>("ids")) values.push_back(value);
+                                      return values;
+                                  }, rounds),
+    };
+
+    std::size_t mismatches{0};
+    for (const auto &report: reports) {
+        report.print();
+        mismatches += report.mismatches;
+    }
+    return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+#include <bit>
+#include <type_traits>
+
+/*
+ * Helpers to check a candidate (fast path) implementation against a reference one, both for results and throughput
+ * */
+namespace differential {
+    // either the result of a call, or the message of the @std::invalid_argument it threw
+    template<typename F>
+    auto outcome(F &&function) {
+        using OutcomeT = std::variant<std::invoke_result_t<F>, std::string>;
+        try {
+            return OutcomeT{std::in_place_index<0>, function()};
+        } catch (const std::invalid_argument &exception) {
+            return OutcomeT{std::in_place_index<1>, exception.what()};
+        }
+    }
+
+    // floating point values are compared bitwise, so that NaNs are equal to each other
+    template<typename T>
+    bool same(const T &lhs, const T &rhs) {
+        if constexpr (std::is_same_v<T, double>) return std::bit_cast<std::uint64_t>(lhs) == std::bit_cast<std::uint64_t>(rhs);
+        else if constexpr (std::is_same_v<T, float>) return std::bit_cast<std::uint32_t>(lhs) == std::bit_cast<std::uint32_t>(rhs);
+        else return lhs == rhs;
+    }
+
+    template<typename T>
+    bool same(const std::vector<T> &lhs, const std::vector<T> &rhs) {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(),
+                          [](const T &l, const T &r) { return same(l, r); });
+    }
+
+    template<typename ReferenceF, typename CandidateF>
+    bool same_outcome(ReferenceF &&reference, CandidateF &&candidate) {
+        const auto expected = outcome(std::forward<ReferenceF>(reference));
+        const auto actual = outcome(std::forward<CandidateF>(candidate));
+        if (expected.index() != actual.index()) return false;
+        if (expected.index() == 1) return std::get<1>(expected) == std::get<1>(actual);
+        return same(std::get<0>(expected), std::get<0>(actual));
+    }
+
+    struct Report {
+        std::string name;
+        std::size_t inputs{0};
+        std::size_t mismatches{0};
+        double reference_mb_per_sec{0};
+        double candidate_mb_per_sec{0};
+
+        void print() const {
+            std::printf("%-24s inputs: %8zu, mismatches: %zu, reference: %9.2f MB/s, candidate: %9.2f MB/s, "
+                        "ratio: %.2fx\n", name.c_str(), inputs, mismatches, reference_mb_per_sec,
+                        candidate_mb_per_sec, candidate_mb_per_sec / reference_mb_per_sec);
+        }
+    };
+
+    // an opaque sink so that the compiler can't optimize the measured calls out
+    inline void keep(const void *value) {
+        asm volatile("" : : "r"(value) : "memory");
+    }
+
+    // any setup an input needs (e.g. parsing) must be done while building @inputs, as only the calls are measured
+    template<typename F, typename InputT>
+    double mb_per_sec(F &&function, const std::vector<InputT> &inputs, std::size_t rounds) {
+        std::size_t bytes{0};
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t round = 0; round < rounds; ++round) {
+            for (const auto &input: inputs) {
+                const auto result = outcome([&] { return function(input); });
+                keep(&result);
+                bytes += input.size();
+            }
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(bytes) / (1024 * 1024) / elapsed.count();
+    }
+
+    /**
+     * To compare @candidate against @reference, both are called with each of @inputs
+     * @param name: name of the comparison, for the report
+     * @param inputs: inputs for both functions, all of them are checked for mismatches. Input type must have
+     *                @data and @size (e.g. @std::string), for the report and throughput respectively
+     * @param rounds: number of times @inputs are passed to each function to measure throughput
+     * @return: a @Report with count of mismatches and throughput of both functions
+     */
+    template<typename InputT, typename ReferenceF, typename CandidateF>
+    Report compare(std::string name, const std::vector<InputT> &inputs, ReferenceF reference,
+                   CandidateF candidate, std::size_t rounds) {
+        Report report{std::move(name), inputs.size()};
+        for (const auto &input: inputs) {
+            if (!same_outcome([&] { return reference(input); }, [&] { return candidate(input); })) {
+                ++report.mismatches;
+                std::printf("%s: mismatch for input [%.*s]\n", report.name.c_str(), static_cast<int>(input.size()),
+                            input.data());
+            }
+        }
+        report.reference_mb_per_sec = mb_per_sec(reference, inputs, rounds);
+        report.candidate_mb_per_sec = mb_per_sec(candidate, inputs, rounds);
+        return report;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <utility>
+
+// unlike assert, this is not compiled out in release builds, and aborting is how a fuzzer learns about a bug
+#define FUZZ_ASSERT(CONDITION) \
+    if (!(CONDITION)) std::abort()
+
+namespace fuzz {
+    inline std::string_view as_string_view(const std::uint8_t *data, std::size_t size) {
+        return {reinterpret_cast<const char *>(data), size};
+    }
+
+    // splits @input at the first @sep, the second one is empty if there is no @sep in @input
+    inline std::pair<std::string_view, std::string_view> split_once(std::string_view input, char sep = '\n') {
+        const auto pos = input.find(sep);
+        if (pos == std::string_view::npos) return {input, {}};
+        return {input.substr(0, pos), input.substr(pos + 1)};
+    }
+}
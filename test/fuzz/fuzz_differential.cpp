@@ -0,0 +1,38 @@
+// Fuzzes util functions against their reference versions, any difference in results or exceptions is a bug
+#include <args_parser.h>
+#include "differential.h"
+#include "fuzz.h"
+#include "reference.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    using differential::same_outcome;
+    const auto input = fuzz::as_string_view(data, size);
+    const auto [sep, source] = fuzz::split_once(input);
+
+    FUZZ_ASSERT(same_outcome([&] { return reference::strip(source, sep); }, [&] { return util::strip(source, sep); }));
+    FUZZ_ASSERT(same_outcome([&] { return reference::split(source, sep); }, [&] { return util::split(source, sep); }));
+    FUZZ_ASSERT(same_outcome([&] { return reference::split(source, sep); }, [&] {
+        std::vector<std::string> sub_strings{};
+        for (const auto sub_string: util::lazy_split(source, std::string{sep})) sub_strings.emplace_back(sub_string);
+        return sub_strings;
+    }));
+
+    FUZZ_ASSERT(same_outcome([&] { return reference::from_string<bool>(input); },
+                             [&] { return util::from_string<bool>(input); }));
+    FUZZ_ASSERT(same_outcome([&] { return reference::from_string<char>(input); },
+                             [&] { return util::from_string<char>(input); }));
+    FUZZ_ASSERT(same_outcome([&] { return reference::from_string<long>(input); },
+                             [&] { return util::from_string<long>(input); }));
+    FUZZ_ASSERT(same_outcome([&] { return reference::from_string<double>(input); },
+                             [&] { return util::from_string<double>(input); }));
+
+    if (!sep.empty()) {
+        // same as ParsedArgs::get_list, which isn't reachable without parsing
+        FUZZ_ASSERT(same_outcome([&] { return reference::get_list<int>(source, sep); }, [&] {
+            std::vector<int> values{};
+            for (const auto &sub_string: util::split(source, sep)) values.push_back(util::from_string<int>(sub_string));
+            return values;
+        }));
+    }
+    return 0;
+}
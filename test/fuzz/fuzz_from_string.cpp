@@ -0,0 +1,35 @@
+// Fuzzes util::from_string for all supported types, converted values must survive a round trip
+#include <args_parser.h>
+#include "fuzz.h"
+#include <cmath>
+
+namespace {
+    template<typename T>
+    void round_trip(std::string_view src) {
+        try {
+            const auto value = util::from_string<T>(src);
+            if constexpr (std::is_floating_point_v<T>) {
+                // std::to_string for floating point types isn't exact, so only checking it doesn't throw
+                if (std::isfinite(value)) static_cast<void>(util::from_string<T>(util::to_string(value)));
+            } else {
+                FUZZ_ASSERT(util::from_string<T>(util::to_string(value)) == value);
+            }
+        } catch (const std::invalid_argument &) {
+            // the only expected exception for invalid input
+        }
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    const auto src = fuzz::as_string_view(data, size);
+
+    round_trip<std::string>(src);
+    round_trip<char>(src);
+    round_trip<bool>(src);
+    round_trip<int>(src);
+    round_trip<unsigned long long>(src);
+    round_trip<short>(src);
+    round_trip<double>(src);
+    round_trip<float>(src);
+    return 0;
+}
@@ -0,0 +1,42 @@
+// Fuzzes ArgsParser::parse (and so, validate_and_parse) with each line of input as a command line argument
+#include <args_parser.h>
+#include "fuzz.h"
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    static constexpr std::size_t max_args{8};
+
+    std::vector<std::string> args{"fuzz_parse"};
+    for (auto input = fuzz::as_string_view(data, size); !input.empty() && args.size() <= max_args;) {
+        const auto [arg, rest] = fuzz::split_once(input);
+        args.emplace_back(arg);
+        input = rest;
+    }
+
+    // a lone help arg would print help and exit
+    if (args.size() == 2 && (args[1] == "help" || args[1] == "--help" || args[1] == "-h")) return 0;
+
+    std::vector<char *> argv{};
+    for (auto &arg: args) argv.push_back(arg.data());
+
+    ArgsParser args_parser{};
+    args_parser.add_arg("t", 5, "time interval");
+    args_parser.add_arg("name", "app name", true);
+    args_parser.add_arg("ids", "allowed ids", true);
+
+    try {
+        const auto parsed_args = args_parser.parse(static_cast<int>(argv.size()), argv.data());
+
+        // values are stripped and non-empty, unless not passed at all
+        const auto name = parsed_args.get("name");
+        FUZZ_ASSERT(name.empty() || util::strip(name) == name);
+
+        static_cast<void>(parsed_args.get_opt<int>("t"));
+        static_cast<void>(parsed_args.get_list<std::string>("ids"));
+        static_cast<void>(parsed_args.get_opt<double>("ids"));
+    } catch (const std::invalid_argument &) {
+        // the only expected exception, for both invalid args and invalid values
+    }
+    return 0;
+}
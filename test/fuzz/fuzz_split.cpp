@@ -0,0 +1,24 @@
+// Fuzzes util::split, the first line of input is the separator
+#include <args_parser.h>
+#include "fuzz.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    const auto [sep, source] = fuzz::split_once(fuzz::as_string_view(data, size));
+
+    try {
+        const auto sub_strings = util::split(source, sep);
+        FUZZ_ASSERT(!sep.empty());
+
+        std::size_t total_size{0};
+        for (const auto &sub_string: sub_strings) {
+            FUZZ_ASSERT(!sub_string.empty());
+            FUZZ_ASSERT(sub_string.find(sep) == std::string::npos);
+            FUZZ_ASSERT(source.find(sub_string) != std::string_view::npos);
+            total_size += sub_string.size();
+        }
+        FUZZ_ASSERT(total_size <= source.size());
+    } catch (const std::invalid_argument &) {
+        FUZZ_ASSERT(sep.empty());
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+// Fuzzes util::strip, the first line of input is the set of chars to strip
+#include <args_parser.h>
+#include "fuzz.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    const auto [chars, source] = fuzz::split_once(fuzz::as_string_view(data, size));
+
+    const auto stripped = util::strip_view(source, chars);
+    FUZZ_ASSERT(util::strip(source, chars) == stripped);
+    FUZZ_ASSERT(source.find(stripped) != std::string_view::npos);
+
+    if (stripped.empty()) {
+        FUZZ_ASSERT(source.find_first_not_of(chars) == std::string_view::npos);
+    } else {
+        FUZZ_ASSERT(chars.find(stripped.front()) == std::string_view::npos);
+        FUZZ_ASSERT(chars.find(stripped.back()) == std::string_view::npos);
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <args_parser.h>
+
+/*
+ * Reference versions of util functions which handle untrusted input. These are kept as simple as possible and
+ * must not be optimized, any fast path in util is checked against them by fuzz_differential and differential
+ * */
+namespace reference {
+    inline
+    std::string strip(std::string_view source, std::string_view chars = " ") {
+        const auto first = source.find_first_not_of(chars);
+        if (first == std::string_view::npos) return {};
+        const auto last = source.find_last_not_of(chars);
+        return std::string{source.substr(first, last - first + 1)};
+    }
+
+    inline
+    std::vector<std::string> split(std::string_view source, std::string_view sep) {
+        util::assert_statement(!sep.empty(), "Separator can't be empty");
+
+        std::vector<std::string> sub_strings{};
+        while (!source.empty()) {
+            const auto pos = source.find(sep);
+            if (pos != 0) sub_strings.emplace_back(source.substr(0, pos));
+            if (pos == std::string_view::npos) break;
+            source.remove_prefix(pos + sep.size());
+        }
+        return sub_strings;
+    }
+
+    template<typename T>
+    T from_string(std::string_view src) {
+        if constexpr (std::is_same_v<std::string, T>) {
+            return std::string{src};
+        } else if constexpr (std::is_same_v<char, T>) {
+            util::assert_statement(src.size() == 1, "Can't convert [", src, "], size: [", src.size(), "] to char");
+            return src.front();
+        } else if constexpr (std::is_same_v<bool, T>) {
+            util::assert_statement(src == util::TRUE || src == util::FALSE, "Invalid value [", src,
+                                   "] to parse to bool, expected values:[", util::TRUE, " / ", util::FALSE, "].");
+            return src == util::TRUE;
+        } else {
+            T value{};
+            const auto res = std::from_chars(src.data(), src.data() + src.size(), value);
+            util::assert_statement(res.ec == std::errc() && res.ptr == src.data() + src.size(),
+                                   "Invalid string [", src, "] to convert to numeric type");
+            return value;
+        }
+    }
+
+    template<typename T>
+    std::vector<T> get_list(std::string_view value, std::string_view sep) {
+        std::vector<T> values{};
+        for (const auto &sub_string: split(value, sep)) {
+            values.push_back(from_string<T>(sub_string));
+        }
+        return values;
+    }
+}
@@ -0,0 +1,16 @@
+// A driver for compilers without libFuzzer (e.g. gcc): runs the target once for each file passed as an argument,
+// which is enough to replay a corpus or a crash under sanitizers
+#include <args_parser.h>
+#include <cstdint>
+#include <cstdio>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size);
+
+int main(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        const auto input = util::read_file(argv[i]);
+        LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t *>(input.data()), input.size());
+        std::printf("Executed %s (%zu bytes)\n", argv[i], input.size());
+    }
+    return 0;
+}
@@ -1,5 +1,9 @@
 #include <args_parser.h>
 #include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
 #include "../util.h"
 
 
@@ -190,3 +194,345 @@ TEST_F(SimpleArgsParserTest, InvalidFormatTest) {
     EXPECT_EXCEPTION(simple_args_parser.parse(2, argv4), std::invalid_argument,
                      "Unexpected format: [d4.325], expected format is: [--arg=value]. Try --help");
 }
+
+// for tests which need a file, it is unique per test (and process), so that concurrent runs don't share it
+struct TempFileArgsParserTest : public SimpleArgsParserTest {
+    std::string file_path{temp_file_path()};
+
+    void write_file(const std::string &content) const {
+        std::ofstream{file_path} << content;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file_path);
+    }
+
+    static std::string temp_file_path() {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        const auto file_name = util::concatenate("args_parser_", test_info->test_suite_name(), "_",
+                                                 test_info->name(), "_", static_cast<long>(getpid()), ".txt");
+        return (std::filesystem::temp_directory_path() / file_name).string();
+    }
+};
+
+struct LayeredArgsParserTest : public TempFileArgsParserTest {
+    void TearDown() override {
+        TempFileArgsParserTest::TearDown();
+        unsetenv("ARGS_PARSER_TEST_T");
+        unsetenv("ARGS_PARSER_TEST_NAME");
+        unsetenv("ARGS_PARSER_TEST_IDS");
+        unsetenv("ARGS_PARSER_TEST_UNKNOWN");
+        unsetenv("ARGS_PARSER_TEST_MODE");
+    }
+};
+
+TEST_F(LayeredArgsParserTest, EnvironmentTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("t", 5, "time interval"));
+    EXPECT_TRUE(simple_args_parser.add_arg("name", "app name", false));
+
+    setenv("ARGS_PARSER_TEST_T", " 60 ", 1);
+    setenv("ARGS_PARSER_TEST_NAME", "test_app", 1);
+    setenv("ARGS_PARSER_TEST_UNKNOWN", "ignored", 1);
+
+    char* argv[] = {DUMMY_APP_PATH.data()};
+    auto parsed_args = simple_args_parser.parse(1, argv, {"ARGS_PARSER_TEST_", {}});
+    EXPECT_EQ(60, parsed_args.get<int>("t"));
+    EXPECT_EQ("test_app", parsed_args.get("name"));
+
+    // values are copied, so changing environment after parsing doesn't affect them
+    setenv("ARGS_PARSER_TEST_NAME", "another_app_with_a_longer_name", 1);
+    unsetenv("ARGS_PARSER_TEST_T");
+    EXPECT_EQ(60, parsed_args.get<int>("t"));
+    EXPECT_EQ("test_app", parsed_args.get("name"));
+}
+
+TEST_F(LayeredArgsParserTest, EnvironmentCaseTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("Mode", "app mode", true));
+    EXPECT_TRUE(simple_args_parser.add_arg("name", "app name", true));
+    EXPECT_TRUE(simple_args_parser.add_arg("Name", "another app name", true));
+
+    setenv("ARGS_PARSER_TEST_MODE", "fast", 1);
+    setenv("ARGS_PARSER_TEST_NAME", "test_app", 1);
+
+    char* argv[] = {DUMMY_APP_PATH.data()};
+    auto parsed_args = simple_args_parser.parse(1, argv, {"ARGS_PARSER_TEST_", {}});
+    EXPECT_EQ("fast", parsed_args.get("Mode"));
+
+    // the lower-cased one is preferred, if args differ only in case
+    EXPECT_EQ("test_app", parsed_args.get("name"));
+    EXPECT_EQ("", parsed_args.get("Name"));
+}
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-result"
+TEST_F(LayeredArgsParserTest, InvalidEnvironmentValueTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "allowed ids", true));
+
+    setenv("ARGS_PARSER_TEST_IDS", "1=2", 1);
+
+    char* argv[] = {DUMMY_APP_PATH.data()};
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {"ARGS_PARSER_TEST_", {}}), std::invalid_argument,
+                     "Unexpected format: [ARGS_PARSER_TEST_IDS=1=2], expected format is: [ARGS_PARSER_TEST_ARG=value]");
+}
+#pragma clang diagnostic pop
+
+TEST_F(LayeredArgsParserTest, BlankEnvironmentValueTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("t", 5, "time interval"));
+
+    setenv("ARGS_PARSER_TEST_T", "  ", 1);
+
+    char* argv[] = {DUMMY_APP_PATH.data()};
+    auto parsed_args = simple_args_parser.parse(1, argv, {"ARGS_PARSER_TEST_", {}});
+    EXPECT_EQ(5, parsed_args.get<int>("t"));
+}
+
+TEST_F(LayeredArgsParserTest, ConfigFileTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("t", 5, "time interval"));
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "allowed ids", false));
+
+    write_file("# a comment\n\n t = 60 \r\nids=2,3,4\n");
+
+    char* argv[] = {DUMMY_APP_PATH.data()};
+    auto parsed_args = simple_args_parser.parse(1, argv, {{}, {file_path}});
+    EXPECT_EQ(60, parsed_args.get<int>("t"));
+    EXPECT_EQ((std::vector<int>{2, 3, 4}), parsed_args.get_list<int>("ids"));
+}
+
+TEST_F(LayeredArgsParserTest, PrecedenceTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("t", 5, "time interval"));
+    EXPECT_TRUE(simple_args_parser.add_arg("name", "app name", false));
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "allowed ids", false));
+    EXPECT_TRUE(simple_args_parser.add_arg("level", "log level", true));
+
+    write_file("t=60\nname=from_file\nids=1,2\nlevel=info\n");
+    setenv("ARGS_PARSER_TEST_NAME", "from_env", 1);
+    setenv("ARGS_PARSER_TEST_IDS", "3,4", 1);
+
+    std::string ids_arg{"--ids=5,6"};
+    char* argv[] = {DUMMY_APP_PATH.data(), ids_arg.data()};
+    auto parsed_args = simple_args_parser.parse(2, argv, {"ARGS_PARSER_TEST_", {file_path}});
+
+    EXPECT_EQ((std::vector<int>{5, 6}), parsed_args.get_list<int>("ids"));
+    EXPECT_EQ("from_env", parsed_args.get("name"));
+    EXPECT_EQ(60, parsed_args.get<int>("t"));
+    EXPECT_EQ("info", parsed_args.get("level"));
+
+    // a copy still refers to valid values
+    const auto copied_args = parsed_args;
+    EXPECT_EQ(60, copied_args.get<int>("t"));
+}
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-result"
+TEST_F(LayeredArgsParserTest, InvalidConfigFileTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("t", 5, "time interval"));
+    char* argv[] = {DUMMY_APP_PATH.data()};
+
+    write_file("t=60\nunknown=5\n");
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {{}, {file_path}}), std::invalid_argument,
+                     "Unknown arg: [unknown] in [" + file_path + "]. Try --help");
+
+    write_file("t=60\n# t=70\nt = 80\n");
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {{}, {file_path}}), std::invalid_argument,
+                     "Duplicate arg: [t] at line [3] of [" + file_path + "]");
+
+        write_file("t=60\n\nt==5\n");
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {{}, {file_path}}), std::invalid_argument,
+                     "Unexpected format: [t==5] at line [3] of [" + file_path + "], expected format is: [arg=value]");
+
+    std::filesystem::remove(file_path);
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {{}, {file_path}}), std::invalid_argument,
+                     "Couldn't open file [" + file_path + "]");
+
+    // a directory can be opened, but not read
+    const auto directory = std::filesystem::temp_directory_path().string();
+    EXPECT_EXCEPTION(simple_args_parser.parse(1, argv, {{}, {directory}}), std::invalid_argument,
+                     "Couldn't read file [" + directory + "]");
+}
+#pragma clang diagnostic pop
+
+TEST_F(SimpleArgsParserTest, HelpTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("log_path", "Log file path for app", false));
+    EXPECT_TRUE(simple_args_parser.add_arg("timeout", 60, "Timeout for the app (seconds)"));
+    EXPECT_TRUE(simple_args_parser.add_arg("v", "A rather long description of an argument, long enough to be wrapped "
+                                                "over to the next line", true));
+    EXPECT_TRUE(simple_args_parser.add_arg("w", "line1\nline2\tand\n\n tabs", true));
+
+    EXPECT_EQ("Following is the list of configured arguments:\n"
+              "Mandatory arguments:\n"
+              "  --log_path  Log file path for app\n"
+              "Optional arguments:\n"
+              "  --timeout   Timeout for the app (seconds), Default value: [60]\n"
+              "  --v         A rather long description of an argument, long enough to be\n"
+              "              wrapped over to the next line\n"
+              "  --w         line1 line2 and tabs\n"
+              "  --help      To print this message\n", simple_args_parser.help());
+
+    // help text is rendered again once it gets stale
+    std::string time_arg{"--timeout=5"};
+    std::string log_path_arg{"--log_path=/tmp"};
+    char* argv[] = {DUMMY_APP_PATH.data(), time_arg.data(), log_path_arg.data()};
+    EXPECT_NO_THROW(static_cast<void>(simple_args_parser.parse(3, argv)));
+    EXPECT_TRUE(simple_args_parser.help().starts_with(
+            "Following is the list of configured arguments for host/prod/apps/test_app:\n"));
+
+    EXPECT_TRUE(simple_args_parser.add_arg("a", "An argument", false));
+    EXPECT_NE(std::string_view::npos, simple_args_parser.help().find("  --a         An argument\n"));
+
+    // no trailing spaces without a description
+    EXPECT_TRUE(simple_args_parser.add_arg("e", "", true));
+    EXPECT_NE(std::string_view::npos, simple_args_parser.help().find("\n  --e\n  --timeout"));
+
+    // a long arg doesn't push descriptions of all the other args to the right
+    EXPECT_TRUE(simple_args_parser.add_arg("a_rather_long_argument_name_which_would_not_leave_any_room_for_descriptions",
+                                           "A long argument", true));
+    EXPECT_EQ("Following is the list of configured arguments for host/prod/apps/test_app:\n"
+              "Mandatory arguments:\n"
+              "  --a                         An argument\n"
+              "  --log_path                  Log file path for app\n"
+              "Optional arguments:\n"
+              "  --a_rather_long_argument_name_which_would_not_leave_any_room_for_descriptions\n"
+              "                              A long argument\n"
+              "  --e\n"
+              "  --timeout                   Timeout for the app (seconds), Default value: [60]\n"
+              "  --v                         A rather long description of an argument, long\n"
+              "                              enough to be wrapped over to the next line\n"
+              "  --w                         line1 line2 and tabs\n"
+              "  --help                      To print this message\n", simple_args_parser.help());
+}
+
+TEST_F(SimpleArgsParserTest, StreamTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "list of int values", false));
+
+    std::string ids_arg{"--ids=,2,3,,4,0,"};
+    char* argv[] = {DUMMY_APP_PATH.data(), ids_arg.data()};
+    const auto parsed_args = simple_args_parser.parse(2, argv);
+
+    std::vector<int> ids{};
+    for (auto id: parsed_args.get_stream<int>("ids")) {
+        ids.push_back(id);
+    }
+    EXPECT_EQ(parsed_args.get_list<int>("ids"), ids);
+
+    std::vector<std::string> sub_strings{};
+    for (const auto &sub_string: parsed_args.get_stream<std::string>("ids", ",,")) {
+        sub_strings.push_back(sub_string);
+    }
+    EXPECT_EQ(parsed_args.get_list<std::string>("ids", ",,"), sub_strings);
+
+    // error scenarios
+    EXPECT_EXCEPTION(parsed_args.get_stream<int>("unknown"), std::invalid_argument, "Couldn't find [unknown] in arguments");
+    EXPECT_EXCEPTION(parsed_args.get_stream<int>("ids", ""), std::invalid_argument, "Separator can't be empty");
+}
+
+TEST_F(SimpleArgsParserTest, StreamConversionErrorTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "list of int values", false));
+
+    std::string ids_arg{"--ids=2,3,x,4"};
+    char* argv[] = {DUMMY_APP_PATH.data(), ids_arg.data()};
+    const auto parsed_args = simple_args_parser.parse(2, argv);
+
+    // values before the invalid one are still consumed
+    std::vector<int> ids{};
+    EXPECT_EXCEPTION(for (auto id: parsed_args.get_stream<int>("ids")) ids.push_back(id), std::invalid_argument,
+                     "Invalid string [x] to convert to numeric type");
+    EXPECT_EQ((std::vector<int>{2, 3}), ids);
+}
+
+struct StreamArgsParserTest : public TempFileArgsParserTest {
+};
+
+TEST_F(StreamArgsParserTest, FileStreamTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids_file", "file with list of ids", false));
+
+    // large enough to span multiple chunks
+    std::string ids{};
+    long long expected_sum{0};
+    for (int id = 0; id < 100'000; ++id) {
+        ids.append(util::to_string(id)).append(id % 3 == 0 ? "\n\n" : "\n");
+        expected_sum += id;
+    }
+    write_file(ids);
+
+    std::string ids_file_arg{"--ids_file=" + file_path};
+    char* argv[] = {DUMMY_APP_PATH.data(), ids_file_arg.data()};
+    const auto parsed_args = simple_args_parser.parse(2, argv);
+
+    long long sum{0};
+    int count{0};
+    for (auto id: parsed_args.get_file_stream<int>("ids_file")) {
+        EXPECT_EQ(count++, id);
+        sum += id;
+    }
+    EXPECT_EQ(100'000, count);
+    EXPECT_EQ(expected_sum, sum);
+
+    // CRLF line endings, with a blank line too
+    write_file("1\r\n2\r\n\r\n3\r\n");
+    std::vector<int> crlf_ids{};
+    for (auto id: parsed_args.get_file_stream<int>("ids_file")) {
+        crlf_ids.push_back(id);
+    }
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), crlf_ids);
+
+    // a multi-character separator, without a trailing one
+    write_file("1<>2<><>3");
+    std::vector<std::string> values{};
+    for (const auto &value: parsed_args.get_file_stream<std::string>("ids_file", "<>")) {
+        values.push_back(value);
+    }
+    EXPECT_EQ((std::vector<std::string>{"1", "2", "3"}), values);
+
+    std::filesystem::remove(file_path);
+    EXPECT_EXCEPTION(parsed_args.get_file_stream<int>("ids_file"), std::invalid_argument,
+                     "Couldn't open file [" + file_path + "]");
+}
+
+TEST_F(StreamArgsParserTest, FileStreamReadErrorTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids_file", "file with list of ids", false));
+
+    // a directory can be opened, but not read, which is only known once iteration begins
+    const auto directory = std::filesystem::temp_directory_path().string();
+    std::string ids_file_arg{"--ids_file=" + directory};
+    char* argv[] = {DUMMY_APP_PATH.data(), ids_file_arg.data()};
+    const auto parsed_args = simple_args_parser.parse(2, argv);
+
+    int count{0};
+    EXPECT_EXCEPTION(for ([[maybe_unused]] auto id: parsed_args.get_file_stream<int>("ids_file")) ++count, std::invalid_argument,
+                     "Couldn't read file [" + directory + "]");
+    EXPECT_EQ(0, count);
+}
+
+TEST_F(StreamArgsParserTest, TemporaryStreamTest) {
+    ArgsParser simple_args_parser{};
+    EXPECT_TRUE(simple_args_parser.add_arg("ids", "list of int values", false));
+    EXPECT_TRUE(simple_args_parser.add_arg("more_ids", 23, "list of int values"));
+
+    // values are in buffers owned by the temporary ParsedArgs, which is destroyed before the loops begin
+    write_file("ids=4,5,6\n");
+    char* argv[] = {DUMMY_APP_PATH.data()};
+
+    std::vector<int> ids{};
+    for (auto id: simple_args_parser.parse(1, argv, {{}, {file_path}}).get_stream<int>("ids")) {
+        ids.push_back(id);
+    }
+    EXPECT_EQ((std::vector<int>{4, 5, 6}), ids);
+
+    std::vector<int> more_ids{};
+    for (auto id: simple_args_parser.parse(1, argv, {{}, {file_path}}).get_stream<int>("more_ids")) {
+        more_ids.push_back(id);
+    }
+    EXPECT_EQ((std::vector<int>{23}), more_ids);
+}
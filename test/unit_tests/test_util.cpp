@@ -39,6 +39,15 @@ TEST_F(UtilTest, StripTestWithExplicitArg) {
     EXPECT_EQ(util::strip("0123 He3llo 3", "0123"), " He3llo ");
 }
 
+TEST_F(UtilTest, StripEdgeCaseTest) {
+    // nothing is left to return if @source is made of @chars only
+    EXPECT_EQ(util::strip(""), "");
+    EXPECT_EQ(util::strip("   "), "");
+    EXPECT_EQ(util::strip("0x0xx0", "0x"), "");
+    EXPECT_EQ(util::strip_view("0x0xx0", "0x"), "");
+    EXPECT_EQ(util::strip("Hello", ""), "Hello");
+}
+
 TEST_F(UtilTest, SplitTest) {
     EXPECT_EQ(util::split("Hello! Testing split"), get_vector({"Hello!", "Testing", "split"}));
     EXPECT_EQ(util::split("  "), get_vector({}));
@@ -58,6 +67,31 @@ TEST_F(UtilTest, SplitEdgeCaseTest) {
     EXPECT_EQ(util::split("0123456789Hello0123456789", "0123456789"), get_vector({"Hello"}));
 }
 
+TEST_F(UtilTest, LazySplitTest) {
+    const auto lazy_split = [](std::string_view source, std::string sep) {
+        std::vector<std::string> result{};
+        for (const auto sub_string: util::lazy_split(source, std::move(sep))) {
+            result.emplace_back(sub_string);
+        }
+        return result;
+    };
+
+    for (const auto &source: {"Hello! Testing split", "  ", "", "Hello "}) {
+        EXPECT_EQ(lazy_split(source, " "), util::split(source, " "));
+    }
+    for (const auto &source: {"Hello12 ", "12Hello12there!", "12 Hello 12 there!", "1212Hello121", "Hello"}) {
+        EXPECT_EQ(lazy_split(source, "12"), util::split(source, "12"));
+    }
+
+    // error scenarios
+    EXPECT_EXCEPTION(lazy_split("Hello", ""), std::invalid_argument, "Separator can't be empty");
+}
+
+TEST_F(UtilTest, SplitEmptySeparatorTest) {
+    EXPECT_EXCEPTION(util::split("Hello", ""), std::invalid_argument, "Separator can't be empty");
+    EXPECT_EXCEPTION(util::split("", ""), std::invalid_argument, "Separator can't be empty");
+}
+
 TEST_F(UtilTest, BoolConversionTest) {
     EXPECT_EQ("false", util::to_string(false));
     EXPECT_EQ(false, util::from_string<bool>("false"));